@@ -1,14 +1,22 @@
 include(GNUInstallDirs)
 set(DAISY_SAMPLE_DESTINATION "${CMAKE_INSTALL_DATADIR}/daisy/sample")
 set(DAISY_LIB_DESTINATION "${CMAKE_INSTALL_DATADIR}/daisy/lib")
-set(DAISY_CORE_NAME ${DAISY_BIN_NAME})
+set(DAISY_CORE_NAME core)
 
-target_include_directories(${DAISY_BIN_NAME} PUBLIC include)
-target_compile_options(${DAISY_BIN_NAME} PRIVATE ${COMPILE_OPTIONS})
-target_link_options(${DAISY_BIN_NAME} PRIVATE ${LINKER_OPTIONS})
-target_link_libraries(${DAISY_BIN_NAME} PUBLIC
+# Everything except main is compiled once as an object library (core),
+# which is linked into the executable and into tests needing all of
+# Daisy.
+add_library(${DAISY_CORE_NAME} OBJECT)
+target_include_directories(${DAISY_CORE_NAME} PUBLIC include)
+target_compile_options(${DAISY_CORE_NAME} PRIVATE ${COMPILE_OPTIONS})
+target_link_libraries(${DAISY_CORE_NAME} PUBLIC
   cxsparse
   Boost::filesystem
 )
 
+target_include_directories(${DAISY_BIN_NAME} PUBLIC include)
+target_compile_options(${DAISY_BIN_NAME} PRIVATE ${COMPILE_OPTIONS})
+target_link_options(${DAISY_BIN_NAME} PRIVATE ${LINKER_OPTIONS})
+target_link_libraries(${DAISY_BIN_NAME} PUBLIC ${DAISY_CORE_NAME})
+
 install(TARGETS ${DAISY_BIN_NAME} RUNTIME DESTINATION bin)
@@ -0,0 +1,100 @@
+/* cdaisy.h -- C interface for running Daisy from another program.
+ *
+ * Copyright 2026 KU.
+ *
+ * This file is part of Daisy.
+ *
+ * Daisy is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation; either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * Daisy is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with Daisy; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/* The caller parses one or more setup files, initializes the
+ * simulation, and then advances it a number of timesteps at a time.
+ * Between steps, values can be read from 'extern' logs and written to
+ * 'exchange' scopes of the 'output' component.  Both are accessed
+ * through integer handles, resolved once by name, so no lookup is
+ * needed in the inner loop.
+ *
+ * Functions returning int use 0 for success and -1 for failure,
+ * unless otherwise noted.  The reason for the last failure is
+ * available from 'daisy_model_error'.  */
+
+#ifndef CDAISY_H
+#define CDAISY_H
+
+#ifdef __unix
+#define CDAISY_EXPORT /* Nothing */
+#elif defined (BUILD_DLL)
+/* DLL export */
+#define CDAISY_EXPORT __declspec(dllexport)
+#else
+/* EXE import */
+#define CDAISY_EXPORT __declspec(dllimport)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct daisy_model daisy_model;
+
+/* Create and destroy. */
+CDAISY_EXPORT daisy_model* daisy_model_create (void);
+CDAISY_EXPORT void daisy_model_delete (daisy_model*);
+
+/* Setup.  Parse any number of files, then initialize once. */
+CDAISY_EXPORT int daisy_model_parse_file (daisy_model*, const char* file);
+CDAISY_EXPORT int daisy_model_initialize (daisy_model*);
+
+/* Simulation.  Advance up to 'steps' timesteps, and return the number
+ * of timesteps that advanced the simulation time, or -1 on failure.
+ * Fewer steps are taken if the simulation reaches its 'stop'
+ * condition.  */
+CDAISY_EXPORT int daisy_model_step (daisy_model*, int steps);
+CDAISY_EXPORT int daisy_model_is_running (const daisy_model*);
+CDAISY_EXPORT int daisy_model_time (const daisy_model*,
+                                    int* year, int* month,
+                                    int* mday, int* hour);
+
+/* Output from the 'extern' log named 'log'.  The array pointer refers
+ * directly to the simulation state, and is valid until the next call
+ * to 'daisy_model_step'.  For an invalid handle, 'check' and 'size'
+ * return -1, 'number' returns NaN, and 'array' returns NULL.  */
+CDAISY_EXPORT int daisy_model_output_handle (daisy_model*, const char* log,
+                                             const char* tag);
+CDAISY_EXPORT int daisy_model_output_check (const daisy_model*, int handle);
+CDAISY_EXPORT double daisy_model_output_number (const daisy_model*,
+                                                int handle);
+CDAISY_EXPORT int daisy_model_output_size (const daisy_model*, int handle);
+CDAISY_EXPORT const double* daisy_model_output_array (const daisy_model*,
+                                                      int handle);
+
+/* Input to the 'exchange' scope named 'scope'. */
+CDAISY_EXPORT int daisy_model_input_handle (daisy_model*, const char* scope,
+                                            const char* tag);
+CDAISY_EXPORT int daisy_model_input_set (daisy_model*, int handle,
+                                         double value);
+
+/* Errors. */
+CDAISY_EXPORT const char* daisy_model_error (const daisy_model*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#undef CDAISY_EXPORT
+
+#endif /* CDAISY_H */
+
+/* cdaisy.h ends here. */
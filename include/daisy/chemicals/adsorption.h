@@ -24,6 +24,7 @@
 #define ADSORPTION_H
 
 #include "object_model/model_derived.h"
+#include <vector>
 
 class Log;
 class Soil;
@@ -51,10 +52,39 @@ private:
 			 double Theta, double T,
 			 int i, double M, double sf) const = 0;
 protected:
+  // Find M at both ends of [C_lower; C_upper].  Return true with the
+  // solution in C if it is trivial or outside the interval.
+  bool M_to_C_bracket (const Soil&, const Chemical&, const AWI&,
+		       double Theta, double T,
+		       int i, double M, double sf,
+		       double C_lower, double C_upper,
+		       double& M_lower, double& M_upper, double& C) const;
   double M_to_C_bisect (const Soil&, const Chemical&, const AWI&,
 			double Theta, double T,
 			int i, double M, double sf,
 			double C_lower, double C_upper) const;
+  // As M_to_C_bisect, with fewer C_to_M calls.  A C_guess within
+  // the interval is tried first, pass a negative value for none.
+  double M_to_C_solve (const Soil&, const Chemical&, const AWI&,
+		       double Theta, double T,
+		       int i, double M, double sf,
+		       double C_lower, double C_upper,
+		       double C_guess) const;
+  double M_to_C_solve (const Soil&, const Chemical&, const AWI&,
+		       double Theta, double T,
+		       int i, double M, double sf,
+		       double C_lower, double M_lower,
+		       double C_upper, double M_upper,
+		       double C_guess) const;
+  // For models building on another adsorption model.
+  static double model_C_to_M (const Adsorption& model,
+			      const Soil&, const Chemical&, const AWI&,
+			      double Theta, double T,
+			      int i, double C, double sf);
+  static double model_M_to_C (const Adsorption& model,
+			      const Soil&, const Chemical&, const AWI&,
+			      double Theta, double T,
+			      int i, double M, double sf);
 public:
   double C_to_M_total (const Soil&, const Chemical&, const AWI&,
 		       double Theta, double T,
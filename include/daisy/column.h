@@ -122,6 +122,7 @@ public:
   virtual void set_surface_detention_capacity (double height) = 0; // [mm]
   virtual void remove_solute (symbol chemical) = 0;
   virtual double total_solute (const symbol chem) const = 0; //[g/ha]
+  virtual double surface_runoff () const = 0; // [mm/h]
 
   // Conditions.
 public:
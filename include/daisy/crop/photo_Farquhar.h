@@ -51,6 +51,8 @@ protected:
   const double Ea_Gamma; // Activation energy for Gamma
   std::unique_ptr<RubiscoNdist> rubiscoNdist;// Crop N distribution model.
   std::unique_ptr<StomataCon> Stomatacon;// Stomata conductance.
+  const bool warm_start;         // Start from last solution.
+  const bool converge_gs;        // Require stomata conductance converged.
 
   // Log variable.
   std::vector<double> ci_vector; // Stomata CO2 pressure
@@ -78,6 +80,33 @@ protected:
   double leafPhotN;              // Content of photosynthetic active leaf N
   double fraction_total;         // total fraction of leaf active in photosynthesis.
   double ABA_effect;
+  int iterations;                // Fixed point iterations, all layers.
+  int max_iterations;            // Fixed point iterations, worst layer.
+
+  // Layers with light, solved together.
+  struct Layers
+  {
+    std::vector<int> index;      // Canopy interval.
+    std::vector<double> LA;      // Leaf area [m^2 leaf/m^2 area]
+    std::vector<double> dPAR;    // Absorbed PAR [mol/m^2 leaf/s]
+    std::vector<double> vmax25;  // Rubisco capacity [mol/m^2 leaf/s]
+    std::vector<double> rd;      // Leaf respiration [mol/m^2 leaf/s]
+    std::vector<double> ci;      // Stomata CO2 pressure [Pa]
+    std::vector<double> gsw;     // Stomata conductance [mol/m^2 leaf/s]
+    std::vector<double> pn;      // Net photosynthesis [mol/m^2 leaf/s]
+    std::vector<double> hs;      // Relative humidity at leaf surface []
+    std::vector<double> cs;      // Leaf surface CO2 [Pa]
+    std::vector<size_t> active;  // Layers not yet converged.
+    void clear ();
+    void add (int i, double LA, double dPAR, double vmax25, double rd,
+              double ci, double gsw);
+  } layers;
+
+  // State.
+  // Solution from last call for each canopy interval, used as the
+  // initial guess with 'warm_start'.  Non-positive if none.
+  std::vector<double> ci_guess;
+  std::vector<double> gsw_guess;
     
   // Simulation.
 public:
@@ -96,6 +125,9 @@ private:
 		       const double gsw, const double gbw, 
                        const double Tl, const double Vm_25, 
 		       const double rd, Treelog& msg) const = 0;
+  void solve_layers (double ABA, double h_x, double ec, double estar,
+                     double CO2_atm, double O2_atm, double Ptot, double Tl,
+                     Treelog& msg);
 public:
   double assimilate (const Units&, 
                      const double ABA_xylem, const double psi_c,
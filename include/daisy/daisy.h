@@ -34,6 +34,7 @@ class Treelog;
 class Time;
 class Units;
 class Scope;
+class MScope;
 class Frame;
 class FrameModel;
 
@@ -49,6 +50,7 @@ private:
 public:
   const FrameModel& frame () const;
   const std::vector<const Scope*>& scopes () const;
+  MScope* exchange (symbol title) const; // NULL if not found.
   const Time& time () const;
   const Time& previous () const;
   const Units& units () const;
@@ -65,9 +67,18 @@ public:
   // Simulation.
 public:
   bool run (Treelog&);
+  // One timestep of 'run'.  Return true while still running.
+  bool step (Treelog&);
+  void summarize (Treelog&) const;
   void tick (Treelog&);
   void output (Log&) const;
 
+  // Checkpoint.
+public:
+  // Full simulation state, as a checkpoint would store it, but kept
+  // in memory.  Suitable as a parent for continuing the simulation.
+  std::unique_ptr<FrameModel> snapshot (Treelog&) const;
+
   // Create and Destroy.
 public:
   void initialize (Block&);
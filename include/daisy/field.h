@@ -159,6 +159,7 @@ public:
   bool initialize (const Block&, const std::vector<const Scope*> scopes,
                    const Time&, const Weather*,
 		   const Scope&);
+  static void load_syntax (Frame&);
   Field (const Block&, const std::string& key);
   void summarize (Treelog& msg) const;
   ~Field ();
@@ -76,6 +76,8 @@ public:
   void pour (std::vector<double>& cc, std::vector<double>& nn);
   void add (double C, double N);// Add dead leafs.
   void add (const Geometry& geometry, AM& other); // Merge AOMs.
+  bool can_merge (const AM& other) const; // Same pools and parameters.
+  void merge (const Geometry& geometry, AM& other); // Merge pool by pool.
   void add_surface (const Geometry&,	// Add dead roots.
                     double C, double N, 
                     const std::vector<double>& density);
@@ -72,6 +72,8 @@ public:
 	     double* CO2, const std::vector<SMB*>& smb, 
 	     double* som_C, double* som_N, const std::vector<DOM*>& dom,
              double dt);
+  bool can_merge (const AOM& other) const; // Same turnover parameters.
+  void merge (AOM& other);	// Move all content from other.
 private:
   // Disallow this OM function.
   void tick (const std::vector<bool>&, const double* turnover_factor, 
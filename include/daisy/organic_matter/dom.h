@@ -74,6 +74,7 @@ public:
   double N_at (unsigned int at) const;
 public:
   void clear ();
+  void scale_source (double factor);
   void turnover (const std::vector<bool>&, const double* turnover_factor, 
 		 const double* N_soil, double* N_used,
 		 double* CO2, const std::vector<SMB*>& smb, double dt);
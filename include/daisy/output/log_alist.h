@@ -107,6 +107,7 @@ struct LogSubmodel : public Log
   // Create and Destroy.
   bool check (const Border&, Treelog& err) const;
   LogSubmodel (const BlockModel&);
+  explicit LogSubmodel (const char* id);
   ~LogSubmodel ();
 };
 
@@ -54,21 +54,29 @@ private:
   
   // Destination Content.
   typedef enum { Missing, Number, Name, Array } intern_type;
-  typedef std::map<symbol, intern_type> type_map;
-  typedef std::map<symbol, double> number_map;
-  typedef std::map<symbol, symbol> name_map;
-  typedef std::map<symbol, int> int_map;
-  typedef std::map<symbol, const std::vector<double>*> array_map;
-  type_map types;
-  number_map numbers;
-  name_map names;
-  array_map arrays;
-  int_map sizes;
-  name_map dimensions;
+  struct Slot
+  {
+    intern_type type;
+    bool has_number;
+    double number;
+    symbol name;
+    const std::vector<double>* array;
+    bool has_size;
+    int size;
+    bool has_dimension;
+    symbol dimension;
+    Slot ();
+  };
+  std::vector<Slot> slots;	// Indexed by handle.
+  typedef std::map<symbol, int> handle_map;
+  handle_map handles;
+  std::vector<int> entry_slot;	// Slot for each entry.
+  int find_slot (symbol tag);
+  const Slot* lookup_slot (symbol tag) const;
 
   // Log.
   void find_scopes (std::vector<const Scope*>&) const;
-  symbol last_done;
+  int last_done;
   void done_print  (const std::vector<Time::component_t>& time_columns,
                     const Time& time);
 
@@ -96,6 +104,16 @@ public:
   symbol name (symbol tag) const;
   symbol description (symbol) const;
 
+  // Handles.  A handle is valid for the lifetime of the log, and
+  // avoids the lookup by name when exchanging values every timestep.
+public:
+  int handle (symbol tag) const; // -1 if unknown.
+  bool check (int handle) const;
+  bool has_number (int handle) const;
+  double number (int handle) const;
+  int value_size (int handle) const;
+  const double* array (int handle) const; // NULL if not an array.
+
   // Create and destroy.
   void initialize (const symbol log_dir, const symbol suffix, Treelog&);
 public:
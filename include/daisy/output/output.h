@@ -59,6 +59,7 @@ public:
   size_t scope_size () const;
   const Scope& scope (size_t) const;
   const std::vector<const Scope*>& scopes () const;
+  MScope* exchange (symbol title) const;
 
   // Create and Destroy.
 public:
@@ -63,6 +63,9 @@ public:
 			   const double h_old /* [cm] */,
 			   const double h /* [cm] */,
 			   const double T);
+  // False if the model has state changed by the functions above.
+  // Otherwise, it may be shared by several soils.
+  virtual bool shareable () const;
 			   
   // Convertion functions.
 public:
@@ -72,6 +75,8 @@ public:
   { return KT (h, 20.0); }
   virtual double Cw2 (double h) const = 0;
   virtual double h (double Theta) const = 0;
+  // Tables used by M must be built by 'initialize', as the solvers
+  // may call M for the same horizon from several threads.
   virtual double M (double h) const = 0;
 private:
   virtual double K (double h) const;
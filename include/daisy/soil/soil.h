@@ -75,7 +75,7 @@ public:
   void tick (const double dt /* [h] */, const double rain /* [mm/h] */,
              const Geometry& geo, const SoilWater& soil_water,
 	     const SoilHeat& soil_heat, Treelog&);
-  void set_porosity (size_t i, double Theta);
+  void set_porosity (size_t i, double Theta, Treelog&);
   // Activation pressure for secondary domain. [cm] 
   double h_secondary (size_t i) const;
   // Exchange rate between primary and secondary water.  [h^-1] 
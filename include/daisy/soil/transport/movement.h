@@ -59,6 +59,7 @@ public:
 private:
   std::vector<size_t> water_fail;
   std::vector<size_t> water_total;
+  std::vector<size_t> water_used;
   std::vector<size_t> solute_fail;
   std::vector<size_t> solute_total;
   int water_failure_level;
@@ -66,6 +67,7 @@ private:
 protected:
   void water_attempt (size_t level);
   void water_failure (size_t level);
+  void water_success (size_t level);
   void solute_attempt (size_t level);
   void solute_failure (size_t level);
 public:
@@ -24,6 +24,7 @@
 #include "object_model/model_framed.h"
 #include "object_model/symbol.h"
 #include <vector>
+#include <string>
 
 class Geometry;
 class GeometryRect;
@@ -51,6 +52,14 @@ public:
 		     const Soil&, SoilWater&, 
                      const SoilHeat&, const Surface&, const Groundwater&, 
                      double dt, Treelog&) = 0;
+  // As 'tick', but return false with a description in 'error' instead
+  // of throwing.  Nothing is changed on failure.
+  virtual bool solve (const GeometryRect&, 
+                      const std::vector<size_t>& drain_cell,
+                      const double drain_water_level, // [cm]
+                      const Soil&, SoilWater&, 
+                      const SoilHeat&, const Surface&, const Groundwater&, 
+                      double dt, std::string& error, Treelog&);
 
   // Create and Destroy.
 public:
@@ -64,11 +64,32 @@ protected:
                                       const double Ext_PAR,
                                       std::vector <double>& Rad,
                                       const double RadinSi);
+  // As 'radiation_distribution', for an extinction coefficient that
+  // depends on the canopy only, not on the position of the sun.
+  void canopy_distribution (const int No, const double LAI,
+                            const double Ref,
+                            const double Si,
+                            const double Ext,
+                            std::vector <double>& Rad,
+                            const double RadinSi);
 private:
   static void intensity_distribution (int No, double LAI,
                                       double Rad0, double Ext_PAR, 
                                       std::vector <double>& Rad);
 
+  // Relative intensity through the canopy, exp (-Ext LAI i / No), for
+  // the most recently used canopy extinction coefficients.
+  struct Profile
+  {
+    int No;
+    double LAI;
+    double Ext;
+    std::vector<double> value;
+  };
+  std::vector<Profile> profiles;
+  size_t next_profile;		// Next entry to replace.
+  const std::vector<double>& profile (int No, double LAI, double Ext);
+
   // Create and Destroy.
 protected:
   Raddist (const BlockModel&);
@@ -51,6 +51,7 @@ public:
 
   // Column.
   virtual double runoff_rate () const = 0; // [h^-1]
+  virtual double runoff () const = 0;      // [mm/h]
   virtual double mixing_resistance () const = 0; // [h/mm]
   virtual double mixing_depth () const = 0; // [cm]
   
@@ -38,6 +38,8 @@ struct SurfaceSimple : public Surface
   // Column.
   double runoff_rate () const // [h^-1]
   { return 0.0; }
+  double runoff () const // [mm/h]
+  { return 0.0; }
   double mixing_resistance () const // [h/mm]
   { return 1.0e9; }
   double mixing_depth () const // [cm]
@@ -113,6 +113,7 @@ protected:
 
   // Create and Destroy.
 protected:
+  void stop_prefetch ();        // Call before moving or changing the source.
   void rewind (const Time& time, Treelog& msg);
   bool initialized_ok () const;
   void initialize_one (Treelog& msg);
@@ -48,6 +48,29 @@ private:
   std::vector<Time> times;
   std::vector<double> values;
   std::vector<double> ebars;
+
+  // Aggregate over time windows while reading.
+private:
+  enum window_t { window_none, window_hour, window_day, 
+                  window_month, window_year };
+  static window_t find_window (symbol name);
+  const window_t window;
+  const symbol window_value;
+  const double fractile;
+  Time window_end;
+  std::vector<double> window_vals;
+  void add_point (const Time& time, double value, double ebar);
+  void flush_window ();
+
+  // Binary cache of the result.
+private:
+  const symbol cache;
+  const std::string cache_key;
+  static std::string make_cache_key (const BlockModel&);
+  std::string cache_stamp () const;
+protected:
+  bool read_cache (symbol& dimension, Treelog&);
+  void finish_entries (symbol dimension, Treelog&);
   
   // Interface.
 public:
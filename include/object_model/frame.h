@@ -85,6 +85,9 @@ class EXPORT Frame : public WScope
   bool check (const Block&) const;
   bool check (const Metalib&, Treelog&) const;
   bool check (const Metalib&, const Frame& frame, Treelog&) const;
+  // Successful checks are remembered until the frame, one of its
+  // parents, or a library changes.  Call this when a library changes.
+  static void forget_checks ();
   
   // Check that a numeric value is within the allowed range.
   bool verify (symbol key, double value, Treelog&) const;
@@ -339,6 +342,7 @@ class EXPORT Frame : public WScope
             const std::vector<boost::shared_ptr<const FrameSubmodel>/**/>&);
   void set (symbol, const std::vector<boost::shared_ptr<const PLF>/**/>&);
   void set_empty (symbol);
+  void copy_value (symbol key, const Frame& other); // Share other's value.
   void set_described (symbol key, double value, symbol desc);
   void set_described (symbol key, const PLF& value, symbol desc);
   void set_cited (symbol key, double value, symbol desc,
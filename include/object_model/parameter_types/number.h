@@ -24,6 +24,7 @@
 
 #include "object_model/symbol.h"
 #include "object_model/model.h"
+#include "object_model/units.h"
 #include <vector>
 
 class Scope;
@@ -44,6 +45,8 @@ public:
   // Simulation.
 protected:
   static bool known (const symbol);
+private:
+  ConvertCache tick_convert;	// Used by tick_value.
 public:
   bool tick_value (const Units&, 
                    double& value, symbol dim, const Scope& , Treelog&);
@@ -24,6 +24,11 @@
 //
 // The points must be added by increasing x value, and the function is
 // defined by drawing a straight line from each added point to the next.
+//
+// Small PLFs keep their points inside the object, and a PLF never
+// gives memory back when cleared, so rebuilding one each timestep
+// does not allocate.  Lookups remember the last segment used, which
+// makes a sequence of increasing arguments cheap.
 
 #ifndef PLF_H
 #define PLF_H
@@ -43,7 +48,7 @@ public:
   // [Forall x < plf.x(0)](plf(x) = plf.y(0))
   // [Forall x > plf.x(plf.size() - 1)](plf(x) = plf.y(plf.size() - 1))
   double operator ()(double x) const;
-  PLF inverse () const;
+  const PLF& inverse () const;	// Valid until this PLF is changed.
   PLF inverse_safe () const;
   double first_interesting () const;
   double last_interesting () const;
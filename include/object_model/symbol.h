@@ -68,6 +68,11 @@ public:
   // Utilities.
 public:
   static bool alphabetical (symbol, symbol); // Sort function.
+  struct Hash                   // For unordered containers.
+  {
+    size_t operator() (const symbol s) const
+    { return s.id; }
+  };
 
   // Create and destroy.
 public:
@@ -89,6 +89,9 @@ private:
   void failure_interface ();
 public:
   void run ();
+  // Alternative to 'run' for driving the program from outside.
+  void start ();
+  void finish ();
   void error (const std::string&);
   state_t state () const;
 
@@ -41,30 +41,73 @@ class EXPORT Treelog : private boost::noncopyable
 {
   // Nesting.
 public:
+  // A nesting name formatted only when needed.
+  class Name
+  {
+  public:
+    virtual std::string str () const = 0;
+    virtual ~Name ();
+  };
+  // Scoped nesting.  The log is only told about the nesting level
+  // if something is written to the log while the level is open, so
+  // the name should be cheap to construct.
   class Open
   {
   private:
     Treelog& log;
+    Open *const outer;
+    bool opened;
+    enum { is_string, is_symbol, is_indexed, is_prefixed,
+           is_model, is_named } kind;
+    const std::string text;
+    const char *const function; // __FUNCTION__, static storage.
+    const symbol first;
+    const symbol second;
+    const size_t index;
+    const Name *const named;
+    std::string name () const;
+    void materialize ();
+    friend class Treelog;
   public:
     Open (Treelog& l, const std::string& name);
     Open (Treelog& l, const symbol name);
     Open (Treelog& l, const char* name);
     Open (Treelog& l, symbol parameter, size_t index, symbol model);
+    Open (Treelog& l, const char* prefix, symbol name);
+    Open (Treelog& l, symbol library, symbol objid, const char* function);
+    Open (Treelog& l, const Name& name); // Must outlive the Open.
     ~Open ();
   };
-  virtual void open (const std::string&) = 0;
-  virtual void close () = 0;
+private:
+  Open* innermost;		// Last Open on this log.
+  void materialize ();
+public:
+  void open (const std::string&);
+  void close ();
   
   // Use.
 public:
-  virtual void debug (const std::string&) = 0;
-  virtual void entry (const std::string&) = 0;
-  virtual void message (const std::string&);
-  virtual void warning (const std::string&);
-  virtual void error (const std::string&);
-  virtual void bug (const std::string&);
-  virtual void touch () = 0;
-  virtual void flush () = 0;
+  void debug (const std::string&);
+  void entry (const std::string&);
+  void message (const std::string&);
+  void warning (const std::string&);
+  void error (const std::string&);
+  void bug (const std::string&);
+  void touch ();
+  void flush ();
+
+  // Implement.
+private:
+  virtual void do_open (const std::string&) = 0;
+  virtual void do_close () = 0;
+  virtual void do_debug (const std::string&) = 0;
+  virtual void do_entry (const std::string&) = 0;
+  virtual void do_message (const std::string&);
+  virtual void do_warning (const std::string&);
+  virtual void do_error (const std::string&);
+  virtual void do_bug (const std::string&);
+  virtual void do_touch () = 0;
+  virtual void do_flush () = 0;
 
   // Create and Destroy.
 public:
@@ -74,8 +117,7 @@ public:
 };
 
 #define TREELOG_MODEL(msg) \
-  Treelog::Open nest (msg, this->library_id () + ": " + this->objid \
-                      + " " + __FUNCTION__)
+  Treelog::Open nest (msg, this->library_id (), this->objid, __FUNCTION__)
 
 #define TREELOG_SUBMODEL(msg, submodel) \
   Treelog::Open nest (msg, submodel + std::string (": ") + __FUNCTION__)
@@ -33,20 +33,20 @@ protected:
   Treelog& child;
 
   // Nesting.
-public:
-  void open (const std::string&);
-  void close ();
+private:
+  void do_open (const std::string&);
+  void do_close ();
 
   // Use.
-public:
-  void debug (const std::string&);
-  void entry (const std::string&);
-  void message (const std::string&);
-  void warning (const std::string&);
-  void error (const std::string&);
-  void bug (const std::string&);
-  void touch ();
-  void flush ();
+private:
+  void do_debug (const std::string&);
+  void do_entry (const std::string&);
+  void do_message (const std::string&);
+  void do_warning (const std::string&);
+  void do_error (const std::string&);
+  void do_bug (const std::string&);
+  void do_touch ();
+  void do_flush ();
 
   // Create and Destroy.
 public:
@@ -57,8 +57,8 @@ public:
 class TreelogSilent : public TreelogChild
 { 
   // Use.
-public:
-  void message (const std::string&);
+private:
+  void do_message (const std::string&);
 
   // Create and Destroy.
 public:
@@ -34,20 +34,20 @@ private:
   std::unique_ptr<Implementation> impl;
 
   // Nesting.
-public:
-  void open (const std::string&);
-  void close ();
+private:
+  void do_open (const std::string&);
+  void do_close ();
 
   // Use.
-public:
-  void debug (const std::string&);
-  void entry (const std::string&);
-  void message (const std::string&);
-  void warning (const std::string&);
-  void error (const std::string&);
-  void bug (const std::string&);
-  void touch ();
-  void flush ();
+private:
+  void do_debug (const std::string&);
+  void do_entry (const std::string&);
+  void do_message (const std::string&);
+  void do_warning (const std::string&);
+  void do_error (const std::string&);
+  void do_bug (const std::string&);
+  void do_touch ();
+  void do_flush ();
 
 public:
   bool running () const;
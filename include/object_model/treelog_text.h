@@ -48,13 +48,13 @@ protected:
   void header ();
 
   // Nesting.
-public:
-  void open (const std::string& name);
-  void close ();
+private:
+  void do_open (const std::string& name);
+  void do_close ();
 
   // Use.
-public:
-  void entry (const std::string&);
+private:
+  void do_entry (const std::string&);
 
   // Create and Destroy.
 protected:
@@ -67,9 +67,9 @@ class TreelogProgress : public TreelogText
   // Implement.
 private:
   void write (const std::string&);
-  void debug (const std::string&);
-  void touch ();
-  void flush ();
+  void do_debug (const std::string&);
+  void do_touch ();
+  void do_flush ();
 
   // Create and Destroy.
 public:
@@ -85,9 +85,9 @@ private:
   std::unique_ptr<Implementation> impl;
 private:
   void write (const std::string&);
-  void debug (const std::string&);
-  void touch ();
-  void flush ();
+  void do_debug (const std::string&);
+  void do_touch ();
+  void do_flush ();
 
   // Use.
 public:
@@ -106,9 +106,9 @@ private:
   struct Implementation;
   std::unique_ptr<Implementation> impl;
   void write (const std::string&);
-  void debug (const std::string&);
-  void touch ();
-  void flush ();
+  void do_debug (const std::string&);
+  void do_touch ();
+  void do_flush ();
 
   // Create and Destroy.
 public:
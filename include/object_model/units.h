@@ -24,6 +24,9 @@
 #include "util/memutils.h"
 #include "object_model/symbol.h"
 #include <boost/noncopyable.hpp>
+#include <unordered_map>
+#include <mutex>
+#include <utility>
 
 class Metalib;
 class Treelog;
@@ -71,8 +74,19 @@ public:
 private:
   typedef auto_map<symbol, const Unit*> unit_map;
   unit_map units;
-  typedef auto_map<symbol, const Convert*> convert_map;
+  typedef std::pair<symbol, symbol> convert_key;
+  struct convert_hash
+  {
+    size_t operator() (const convert_key& key) const
+    {
+      const symbol::Hash hash;
+      return hash (key.first) * 7919 + hash (key.second);
+    }
+  };
+  typedef std::unordered_map<convert_key, const Convert*, convert_hash>
+  /**/ convert_map;
   mutable convert_map conversions;
+  mutable std::mutex conversions_lock;
   const bool allow_old_;
 
   // Special units.
@@ -94,8 +108,10 @@ public:
   double convert (symbol from, symbol to, double) const;
 private:
   static const Convert* create_convertion (const Unit& from, const Unit& to);
+  const Convert& add_convertion (const convert_key&, const Convert*) const;
 public:
   const Convert& get_convertion (symbol from, symbol to) const;
+  const Convert* find_convertion (symbol from, symbol to) const;
 
   // Create and destroy.
 public:
@@ -105,4 +121,26 @@ public:
   ~Units ();
 };
 
+// The conversion last used at one place in the code.  Dimensions
+// rarely change after initialization, so this avoids looking up the
+// units for each value.
+class ConvertCache
+{
+  // Content.
+private:
+  symbol from_;
+  symbol to_;
+  const Convert* convert_;	// NULL if no conversion.
+  const Convert* find (const Units&, symbol from, symbol to);
+
+  // Use.
+public:
+  bool valid (const Units&, symbol from, symbol to, double value);
+  double convert (const Units&, symbol from, symbol to, double value);
+
+  // Create.
+public:
+  ConvertCache ();
+};
+
 #endif // UNITS_H
@@ -199,6 +199,28 @@ namespace Iterative
                    const double epsilon,
                    const PointFunction& fun, const Point& start,
                    Point& result, Treelog&);
+
+  // Find values for a number of points at once, e.g. in parallel.
+  // Return false to stop the search.
+  struct PointsFunction
+  {
+    virtual bool values (const std::vector<Point>&,
+                         std::vector<double>&) = 0;
+  };
+
+  // Differential evolution (DE/rand/1/bin) for finding a global minimum.
+  //
+  // The population of 'NP' points is drawn within 'lower' and 'upper'
+  // using 'seed', so the same seed will give the same sequence of
+  // points.  'F' is the differential weight, and 'CR' the crossover
+  // probability.  Stop when all values are within 'epsilon' of each
+  // other, and return true, or after 'generations' generations, or
+  // when 'fun' says so, and return false.  Either way, store the best
+  // point found in 'result'.
+  bool DifferentialEvolution (size_t NP, size_t generations,
+                              double F, double CR, double epsilon, int seed,
+                              const Point& lower, const Point& upper,
+                              PointsFunction& fun, Point& result, Treelog&);
 }
 
 #endif // ITERATIVE_H
@@ -42,6 +42,7 @@ private:
   // Use.
 public:
   symbol title () const;
+  std::string file_stamp () const;
   bool good ();
   bool read_header (Treelog& msg);
   bool read_header_with_keywords (Frame& keywords, Treelog& msg);
@@ -41,6 +41,8 @@ private:
   // Use.
 public:
   std::unique_ptr<std::istream> open_file (symbol name) const;
+  // As above, also storing the name of the file opened in 'file'.
+  std::unique_ptr<std::istream> open_file (symbol name, symbol& file) const;
   bool set_directory (symbol directory);
   void set_input_directory (symbol directory);
   symbol get_input_directory () const
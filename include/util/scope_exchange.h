@@ -124,6 +124,13 @@ public:
   // WScope.
 public:
   void set (symbol tag, double value);
+
+  // Handles, for exchanging values without lookup by name.
+public:
+  int handle (symbol tag) const; // -1 if unknown.
+  bool check (int handle) const;
+  double number (int handle) const;
+  void set (int handle, double value);
   
   // Create.
 private:
@@ -0,0 +1,108 @@
+// Python module for running Daisy step by step, built on cdaisy.h.
+//
+// Output arrays are returned as read-only numpy views on the simulation
+// state, so no values are copied.  A view is only valid until the next
+// call to step.
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include "daisy/cdaisy.h"
+#include <stdexcept>
+#include <string>
+
+namespace py = pybind11;
+
+class Daisy {
+public:
+  Daisy() : model(daisy_model_create()) {
+    if (!model)
+      throw std::runtime_error("Could not create Daisy model");
+  }
+  ~Daisy() { daisy_model_delete(model); }
+  Daisy(const Daisy&) = delete;
+  Daisy& operator=(const Daisy&) = delete;
+
+  void parse_file(const std::string& file) {
+    check(daisy_model_parse_file(model, file.c_str()));
+  }
+  void initialize() { check(daisy_model_initialize(model)); }
+  int step(int steps) {
+    const int taken = daisy_model_step(model, steps);
+    check(taken);
+    return taken;
+  }
+  bool is_running() const { return daisy_model_is_running(model); }
+  py::tuple time() const {
+    int year, month, mday, hour;
+    check(daisy_model_time(model, &year, &month, &mday, &hour));
+    return py::make_tuple(year, month, mday, hour);
+  }
+
+  int output_handle(const std::string& log, const std::string& tag) {
+    const int handle
+      = daisy_model_output_handle(model, log.c_str(), tag.c_str());
+    check(handle);
+    return handle;
+  }
+  bool output_check(int handle) const {
+    const int result = daisy_model_output_check(model, handle);
+    check(result);
+    return result != 0;
+  }
+  double output_number(int handle) const {
+    output_check(handle);
+    return daisy_model_output_number(model, handle);
+  }
+  py::object output_array(py::object self, int handle) const {
+    output_check(handle);
+    const double* data = daisy_model_output_array(model, handle);
+    if (!data)
+      return py::none();
+    const py::ssize_t size = daisy_model_output_size(model, handle);
+    // Keep the model alive as long as the view.
+    py::array_t<double> view({size}, {sizeof(double)}, data, self);
+    view.attr("setflags")(py::arg("write") = false);
+    return std::move(view);
+  }
+
+  int input_handle(const std::string& scope, const std::string& tag) {
+    const int handle
+      = daisy_model_input_handle(model, scope.c_str(), tag.c_str());
+    check(handle);
+    return handle;
+  }
+  void input_set(int handle, double value) {
+    check(daisy_model_input_set(model, handle, value));
+  }
+
+private:
+  daisy_model* model;
+  void check(int result) const {
+    if (result < 0)
+      throw std::runtime_error(daisy_model_error(model));
+  }
+};
+
+PYBIND11_MODULE(daisy, m) {
+  m.doc() = "Run a Daisy simulation step by step.";
+  py::class_<Daisy>(m, "Daisy")
+    .def(py::init<>())
+    .def("parse_file", &Daisy::parse_file, "Parse a Daisy setup file.")
+    .def("initialize", &Daisy::initialize,
+         "Initialize the simulation after all files are parsed.")
+    .def("step", &Daisy::step, py::arg("steps") = 1,
+         "Advance the simulation, return the number of timesteps taken.")
+    .def("is_running", &Daisy::is_running)
+    .def("time", &Daisy::time, "Current (year, month, mday, hour).")
+    .def("output_handle", &Daisy::output_handle, py::arg("log"),
+         py::arg("tag"), "Handle for 'tag' in the extern log 'log'.")
+    .def("output_check", &Daisy::output_check)
+    .def("output_number", &Daisy::output_number)
+    .def("output_array",
+         [](py::object self, int handle) {
+           return self.cast<const Daisy&>().output_array(self, handle);
+         },
+         "Read-only view of an array value, valid until the next step.")
+    .def("input_handle", &Daisy::input_handle, py::arg("scope"),
+         py::arg("tag"), "Handle for 'tag' in the exchange scope 'scope'.")
+    .def("input_set", &Daisy::input_set);
+}
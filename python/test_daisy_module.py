@@ -0,0 +1,31 @@
+# Run a short step/exchange cycle through the Python module.
+#
+# Usage: python3 test_daisy_module.py SETUP
+# where SETUP is sample/OpenMI_simple.dai, and the module is on the path.
+import math
+import sys
+
+import daisy
+
+model = daisy.Daisy()
+model.parse_file(sys.argv[1])
+model.initialize()
+assert model.is_running()
+assert model.time() == (1986, 12, 1, 1)
+
+output = model.output_handle("Lower_boundary_output", "Matrix percolation")
+table = model.input_handle("Lower_boundary_input_Andeby", "GroundWaterTable")
+
+assert model.step() == 1
+model.input_set(table, -150.0)
+assert model.step(23) == 23
+assert model.time() == (1986, 12, 2, 1)
+assert model.output_check(output)
+assert math.isfinite(model.output_number(output))
+
+try:
+    model.output_number(output + 1)
+except RuntimeError as error:
+    assert "Invalid output handle" in str(error)
+else:
+    raise AssertionError("invalid handle accepted")
@@ -0,0 +1,22 @@
+// ut_daisy_run.h --- run setup files and read their logs in unit tests.
+
+#ifndef UT_DAISY_RUN_H
+#define UT_DAISY_RUN_H
+
+#include <string>
+#include <vector>
+
+// Parse, initialize and run the program in 'setup'.  Return true on
+// success.  Messages go to the usual Daisy treelogs.
+bool ut_daisy_run (const std::string& setup);
+
+// Search 'dir' for input files before the standard libraries.  Must
+// be called before the first run, as Daisy only reads the path once.
+void ut_daisy_path (const std::string& dir);
+
+// Values of the column 'tag' in the data rows of the dlf file 'file'.
+// Empty if the file or the tag is missing.
+std::vector<double> ut_dlf_column (const std::string& file,
+                                   const std::string& tag);
+
+#endif // UT_DAISY_RUN_H